@@ -75,12 +75,29 @@ public:
   /// check if debugging is enabled
   bool debug() const { return _debug; }
 
+  /// is the real space grid split into blocks (BLOCK parallel mode)
+  bool isBlockDecomposed() const { return _parallel_mode == ParallelMode::BLOCK; }
+
+  /// number of blocks along each direction
+  const std::array<unsigned int, 3> & getBlockGrid() const { return _n_blocks; }
+
+  /// block coordinates of the local rank
+  const std::array<unsigned int, 3> & getBlockCoordinates() const { return _block_coordinates; }
+
+  /// rank owning the block at the given offset from the local block (periodic)
+  unsigned int getBlockNeighbor(const std::array<int, 3> & offset) const;
+
+  /// global grid index range [begin, end) of the local real space domain along each direction
+  int64_t getLocalBegin(unsigned int dim) const { return _local_grid_begin[dim]; }
+  int64_t getLocalEnd(unsigned int dim) const { return _local_grid_begin[dim] + _n_local[dim]; }
+
 protected:
   void gridChanged();
 
   void partitionSerial();
   void partitionSlabs();
   void partitionPencils();
+  void partitionBlocks();
 
   torch::Tensor fftSerial(const torch::Tensor & t) const;
   torch::Tensor fftSlab(const torch::Tensor & t) const;
@@ -111,7 +128,7 @@ protected:
   } _floating_precision;
 
   /// parallelization mode
-  const enum class ParallelMode { NONE, FFT_SLAB, FFT_PENCIL } _parallel_mode;
+  const enum class ParallelMode { NONE, FFT_SLAB, FFT_PENCIL, BLOCK } _parallel_mode;
 
   /// host local ranks of all procs
   std::vector<unsigned int> _local_ranks;
@@ -137,6 +154,13 @@ protected:
   std::array<std::vector<int64_t>, 3> _local_end;
   std::array<std::vector<int64_t>, 3> _n_local_all;
 
+  /// global index of the first local real space grid point (x in slab mode splits reciprocal space)
+  std::array<int64_t, 3> _local_grid_begin = {{0, 0, 0}};
+
+  /// number of blocks along each direction and block coordinates of the local rank
+  std::array<unsigned int, 3> _n_blocks = {{1, 1, 1}};
+  std::array<unsigned int, 3> _block_coordinates = {{0, 0, 0}};
+
   ///@{ global domain length in each dimension
   const RealVectorValue _min_global;
   const RealVectorValue _max_global;
@@ -30,14 +30,23 @@ public:
 
   ProjectVectorTensorAux(const InputParameters & parameters);
 
+  virtual void initialSetup() override;
+  virtual void meshChanged() override;
+
 protected:
   virtual RealEigenVector computeValue() override;
 
+  /// precompute the flat buffer index of every node or element
+  void updateGridIndices();
+
   const torch::Tensor & _cpu_buffer;
 
   const unsigned int & _dim;
   const std::array<int64_t, 3> & _n;
   const RealVectorValue & _grid_spacing;
+
+  /// flat buffer index of the first component by node or element id
+  std::vector<int64_t> _grid_index;
 };
 
 #endif
@@ -28,5 +28,10 @@ public:
 protected:
   const Real & _tau;
   const Real & _D; // diameter
+
+  /// sum and number of all speed entries
+  TensorProblem::Reduction & _sum;
+  TensorProblem::Reduction & _count;
+
   Real _Reynolds_number;
 };
@@ -26,5 +26,8 @@ public:
   virtual PostprocessorValue getValue() const override;
 
 protected:
+  /// zero k-vector entry of the local buffer
+  TensorProblem::Reduction & _zero_frequency;
+
   Real _integral;
 };
@@ -26,5 +26,8 @@ public:
   virtual PostprocessorValue getValue() const override;
 
 protected:
+  /// maximum squared norm of the linear operator
+  TensorProblem::Reduction & _max_norm_square;
+
   Real _critical_dt;
 };
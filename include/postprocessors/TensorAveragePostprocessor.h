@@ -26,5 +26,9 @@ public:
   virtual PostprocessorValue getValue() const override;
 
 protected:
+  /// sum and number of all buffer entries
+  TensorProblem::Reduction & _sum;
+  TensorProblem::Reduction & _count;
+
   Real _average;
 };
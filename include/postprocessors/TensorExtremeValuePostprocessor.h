@@ -32,5 +32,8 @@ protected:
     MAX
   } _value_type;
 
+  /// minimum or maximum buffer entry
+  TensorProblem::Reduction & _extreme_value;
+
   Real _value;
 };
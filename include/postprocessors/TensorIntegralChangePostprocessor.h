@@ -27,5 +27,9 @@ public:
 
 protected:
   const std::vector<torch::Tensor> & _u_old;
+
+  /// sum of the absolute change of all buffer entries
+  TensorProblem::Reduction & _change;
+
   Real _integral;
 };
@@ -11,7 +11,7 @@
 #include "TensorPostprocessor.h"
 
 /**
- * Compute the integral of a Tensor buffer
+ * Compute the maximum interface velocity of a Tensor buffer
  */
 class TensorInterfaceVelocityPostprocessor : public TensorPostprocessor
 {
@@ -26,7 +26,14 @@ public:
   virtual PostprocessorValue getValue() const override;
 
 protected:
+  /// device side maximum of the squared interface velocity
+  torch::Tensor maxVelocitySquare();
+
   const std::vector<torch::Tensor> & _u_old;
+
+  /// optional existing reciprocal space representation of the buffer
+  const torch::Tensor * const _u_bar;
+
   unsigned int _dim;
   Real _velocity;
 
@@ -34,4 +41,7 @@ protected:
   const torch::Tensor _i;
 
   const Real _gradient_threshold;
+
+  /// maximum squared interface velocity
+  TensorProblem::Reduction & _max_vsquare;
 };
@@ -11,10 +11,9 @@
 #include "GeneralPostprocessor.h"
 #include "GeneralVectorPostprocessor.h"
 #include "DomainInterface.h"
+#include "TensorProblem.h"
 #include <torch/torch.h>
 
-class TensorProblem;
-
 /**
  * Postprocessor that operates on a buffer
  */
@@ -27,6 +26,11 @@ public:
   TensorPostprocessorTempl(const InputParameters & parameters);
 
 protected:
+  /// register a device side reduction that is transferred to the host in one batch with all others
+  TensorProblem::Reduction &
+  addReduction(std::function<torch::Tensor()> compute,
+               TensorProblem::ReductionType type = TensorProblem::ReductionType::SUM);
+
   TensorProblem & _tensor_problem;
 
   /// The buffer this postprocessor is operating on
@@ -11,6 +11,7 @@
 #include "TensorProblem.h"
 
 class LatticeBoltzmannStencilBase;
+class LBMTensorBuffer;
 
 /**
  * Problem object for solving lattice Boltzmann problems
@@ -44,7 +45,8 @@ public:
 
   const int & getTotalSteps() const { return _t_total; }
 
-  const std::array<int64_t, 3> & getGridSize() const { return _n; }
+  /// grid size of the local block
+  const std::array<int64_t, 3> & getGridSize() const { return _n_local; }
 
   const bool & isBinaryMedia() { return _is_binary_media; }
 
@@ -53,16 +55,81 @@ public:
   const std::vector<int64_t> & getExtendedShape() { return _shape_extended; }
   const std::vector<int64_t> & getExtendedShapeQ() { return _shape_extended_to_q; }
 
+  /// is the fluid-only (indirect addressing) storage mode requested
+  const bool & isSparseStorage() const { return _sparse_storage; }
+
+  /// flat dense grid indices of all fluid nodes (defined once sparse storage is set up)
+  const torch::Tensor & getFluidIndices() const { return _fluid_indices; }
+
+  /// compact source node index for each fluid node and direction (n_fluid marks a solid source)
+  const torch::Tensor & getStreamIndices() const { return _stream_indices; }
+
+  /// gather the fluid nodes of a dense grid tensor into compact storage
+  torch::Tensor compactTensor(const torch::Tensor & dense) const;
+
+  /// scatter a compact tensor back onto the dense grid (solid nodes are zero)
+  torch::Tensor expandTensor(const torch::Tensor & compact) const;
+
   /// sets up slip model
   void enableSlipModel();
 
   /// sets convergence residual
-  void setSolverResidual(const Real & residual) { _convergence_residual = residual; };
+  void setSolverResidual(const Real & residual)
+  {
+    _convergence_residual = residual;
+    _residual_change = torch::Tensor();
+    _residual_norm = torch::Tensor();
+  };
+
+  /// sets the local sums of the convergence residual as device scalars, they are copied to the
+  /// host, summed over all blocks, and divided only at check points
+  void setSolverResidual(const torch::Tensor & change, const torch::Tensor & norm)
+  {
+    _residual_change = change;
+    _residual_norm = norm;
+  }
 
   /// sets tensor to a value (normally zeros) at solid nodes
   void maskedFillSolids(torch::Tensor & t, const Real & value);
 
+  /// sets the solid nodes of a tensor in the current representation of an LBM buffer to zero
+  void maskedFillSolids(torch::Tensor & t, const LBMTensorBuffer & buffer);
+
+  /// LBM buffer with the given name (nullptr if the buffer is of a different type)
+  LBMTensorBuffer * getLBMBuffer(const std::string & buffer_name);
+
+  /**
+   * The operator reads (or supplies) the buffer in its storage representation, the buffer is not
+   * converted to the compute precision around the operator.
+   */
+  void useStorageRepresentation(const TensorOperatorBase & op, const std::string & buffer_name);
+
+  /**
+   * stream a distribution function along the stencil directions (periodic, solids are zero). A
+   * distribution in the storage representation of an LBM buffer gets that representation of zero.
+   */
+  torch::Tensor streamDistribution(const torch::Tensor & f,
+                                   const LBMTensorBuffer * buffer = nullptr);
+
+  /// are boundary populations exchanged with neighboring blocks of a decomposed domain
+  const bool & hasHaloExchange() const { return _halo_exchange; }
+
 protected:
+  /// build fluid node list and streaming neighbor table for sparse storage
+  void initSparseStorage();
+
+  /// run an operator with its reduced precision buffers converted to the compute precision
+  void computeOperator(TensorOperatorBase & op);
+
+  /// set up the neighbor links for the halo exchange of a block decomposed domain
+  void initHaloExchange();
+
+  /// post non-blocking sends of the outgoing boundary populations of f and the matching receives
+  void beginHaloExchange(const torch::Tensor & f);
+
+  /// wait for the incoming populations and stream them into the boundary layer of u
+  void finishHaloExchange(torch::Tensor & u);
+
   /// LBM mesh/media
   torch::Tensor _binary_media;
   const bool _is_binary_media;
@@ -71,6 +138,61 @@ protected:
   std::vector<int64_t> _shape_extended;
   std::vector<int64_t> _shape_extended_to_q;
 
+  /// store only fluid nodes in a compact array
+  const bool _sparse_storage;
+
+  /// sparse storage index tables
+  torch::Tensor _fluid_indices;
+  torch::Tensor _stream_indices;
+
+  /// grid size of the local block
+  const std::array<int64_t, 3> _n_local;
+
+  /// exchange boundary populations with the neighboring blocks during streaming
+  const bool _halo_exchange;
+
+  /// populations streaming from the local block into a neighboring block along a fixed offset
+  struct HaloLink
+  {
+    /// block offset the populations travel along
+    std::array<int, 3> offset;
+    /// rank the outgoing populations are sent to
+    unsigned int send_rank;
+    /// rank the incoming populations (from the opposite side) are received from
+    unsigned int recv_rank;
+    /// message tag, unique per offset
+    int tag;
+    /// stencil directions crossing the block boundary along the offset
+    std::vector<int64_t> directions;
+    std::vector<std::array<int64_t, 3>> velocities;
+    torch::Tensor direction_indices;
+    /// host side message buffers
+    torch::Tensor send_buffer;
+    torch::Tensor recv_buffer;
+  };
+  std::vector<HaloLink> _halo_links;
+  std::vector<MPI_Request> _halo_requests;
+
+  /// buffers stored in a reduced precision between operators
+  std::map<std::string, LBMTensorBuffer *> _reduced_precision_buffers;
+
+  /// buffers each operator handles in their storage representation
+  std::map<const TensorOperatorBase *, std::set<std::string>> _storage_representation_buffers;
+
+  /// reduced precision buffers read by postprocessors (decoded while those execute)
+  std::set<LBMTensorBuffer *> _postprocessed_buffers;
+
+  /// reduced precision buffers touched by an operator
+  struct ReducedPrecisionBuffers
+  {
+    /// buffers the operator only reads (decoded into temporaries)
+    std::vector<LBMTensorBuffer *> inputs;
+    /// buffers the operator supplies (decoded and stored again)
+    std::vector<LBMTensorBuffer *> outputs;
+  };
+  std::map<const TensorOperatorBase *, ReducedPrecisionBuffers>
+      _operator_reduced_precision_buffers;
+
   /// LBM stencils object
   std::shared_ptr<LatticeBoltzmannStencilBase> _stencil;
 
@@ -93,12 +215,20 @@ protected:
   /// convergence residual
   Real _convergence_residual = 1;
 
+  /// numerator and denominator of the convergence residual on the device (pending copy to
+  /// _convergence_residual)
+  torch::Tensor _residual_change;
+  torch::Tensor _residual_norm;
+
   /// total number of time steps taken
   int _t_total = 0;
 
   /// lbm substeps
   const unsigned int _lbm_substeps;
 
+  /// number of substeps between convergence residual syncs
+  const unsigned int _convergence_check_interval;
+
   /// lbm convergence tolerance
   const Real _tolerance;
 
@@ -24,6 +24,7 @@
 #include "libmesh/print_trace.h"
 
 #include <cstddef>
+#include <functional>
 #include <list>
 #include <memory>
 #include <torch/torch.h>
@@ -153,13 +154,44 @@ public:
 
   static TensorProblem & cast(MooseObject * moose_object, Problem & problem);
 
+  /// combination of partial reductions across ranks of a decomposed domain
+  enum class ReductionType
+  {
+    SUM,
+    MIN,
+    MAX,
+    LOCAL
+  };
+
+  /// device side scalar that is transferred to the host in a batch with all other reductions
+  struct Reduction
+  {
+    std::function<torch::Tensor()> compute;
+    const ReductionType type;
+    const ExecFlagEnum & execute_on;
+    Real value;
+    bool ready;
+  };
+
+  /// register a reduction that is evaluated before the postprocessors on the given flags execute
+  Reduction & addReduction(std::function<torch::Tensor()> compute,
+                           ReductionType type,
+                           const ExecFlagEnum & execute_on);
+
+  /// host value of a reduction (evaluated on its own if it was not part of a batch)
+  Real getReductionValue(Reduction & reduction);
+
 protected:
+  /// evaluate all reductions due on the given execution flag with a single host transfer
+  void computeReductions(const ExecFlagType & exec_type);
+
+  /// evaluate a set of reductions with a single host transfer
+  void computeReductions(const std::vector<Reduction *> & reductions);
+
   void updateDOFMap();
 
-  template <typename FLOAT_TYPE>
   void mapBuffersToAux();
 
-  template <typename FLOAT_TYPE>
   void mapAuxToBuffers();
 
   virtual void addTensorCompute(const std::string & compute_name,
@@ -197,7 +229,7 @@ protected:
   std::map<std::string, std::shared_ptr<TensorBufferBase>> _tensor_buffer;
 
   /// old timesteps
-  std::vector<Real> _old_dt;
+  std::vector<Real> & _old_dt;
 
   const unsigned int & _dim;
 
@@ -230,15 +262,28 @@ protected:
   /// map from buffer name to variable name
   std::map<std::string, AuxVariableName> _buffer_to_var_name;
 
+  /// permutation between flat buffer entries and solution vector indices
+  struct DOFMap
+  {
+    /// solution vector index of every mapped node or element
+    torch::Tensor dofs;
+    /// flat buffer index of every mapped node or element (periodic nodes wrap around)
+    torch::Tensor source;
+  };
+
   /// buffers to solution vector indices
-  std::map<std::string, std::tuple<const MooseVariableFieldBase *, std::vector<std::size_t>, bool>>
-      _buffer_to_var;
-  std::map<std::string, std::tuple<const MooseVariableFieldBase *, std::vector<std::size_t>, bool>>
-      _var_to_buffer;
+  std::map<std::string, std::tuple<const MooseVariableFieldBase *, DOFMap, bool>> _buffer_to_var;
+  std::map<std::string, std::tuple<const MooseVariableFieldBase *, DOFMap, bool>> _var_to_buffer;
 
   /// The [TensorSolver]
   std::shared_ptr<TensorSolver> _solver;
 
+  /// are CPU buffer copies read on the main thread (auxkernels, aux variable mapping)
+  bool _cpu_buffer_access;
+
+  /// registered postprocessor reductions
+  std::vector<std::unique_ptr<Reduction>> _reductions;
+
   /// parameters
   std::map<std::string, std::unique_ptr<Swift::ConstantBase>> _constants;
   std::set<std::string> _fetched_constants;
@@ -61,4 +61,10 @@ public:
 
   // reorder indices to cosntruct square/cube
   torch::Tensor _reorder_indices;
+
+  // q x q projection of fneq onto the second order Hermite space (fneq_hat = fneq x P)
+  torch::Tensor _hermite_projection;
+
+  /// build _hermite_projection for the lattice speed of sound squared cs2 of the problem
+  void computeHermiteProjection(const Real cs2);
 };
@@ -25,12 +25,75 @@ public:
 
   void init() override;
   virtual void makeCPUCopy() override;
+  virtual torch::Tensor getOutputTensor() const override;
+  virtual void storeState(std::ostream & stream) override;
+  virtual void loadState(std::istream & stream) override;
+
+  /// is the tensor kept in a reduced (or shifted) storage precision between operators
+  bool hasReducedStorage() const { return _reduced_storage; }
+
+  /// are the current and old tensors held in the storage representation right now
+  bool isEncoded() const { return _encoded; }
+
+  /// convert the current tensor to the storage precision
+  void encode();
+
+  /// convert the current tensor back to the compute precision (old states are exposed decoded)
+  void decode();
+
+  /// expose compute precision temporaries to an operator that only reads the buffer
+  void beginRead();
+
+  /// drop the temporaries and restore the unchanged storage representation
+  void endRead();
+
+  /// compute precision values minus the current representation (non-zero only if stored shifted)
+  const torch::Tensor & storageOffset() const;
+
+  /// widen a tensor from the current representation to the compute precision
+  torch::Tensor toCompute(const torch::Tensor & t) const { return _encoded ? load(t) : t; }
+
+  /// convert a compute precision tensor to the current representation
+  torch::Tensor toStorage(const torch::Tensor & t) const { return _encoded ? store(t) : t; }
+
+  /// do both buffers currently hold their data in the same representation
+  bool sameRepresentation(const LBMTensorBuffer & other) const;
 
   void readTensorFromFile(const std::vector<int64_t> &);
   void readTensorFromHdf5();
 
 protected:
+  /// storage representation of a compute precision tensor
+  torch::Tensor store(const torch::Tensor & t) const;
+  /// compute precision tensor from its storage representation
+  torch::Tensor load(const torch::Tensor & t) const;
+
   const std::string _buffer_type;
   LatticeBoltzmannProblem & _lb_problem;
   const LatticeBoltzmannStencilBase & _stencil;
+
+  /// store f - w_i rather than f (distribution functions only)
+  const bool _shifted;
+
+  /// storage precision (defaults to the compute precision)
+  torch::ScalarType _storage_dtype;
+
+  /// is a storage representation different from the compute representation requested
+  bool _reduced_storage;
+
+  /// lattice weights subtracted for shifted storage
+  torch::Tensor _shift;
+
+  /// offset of an unshifted representation
+  torch::Tensor _no_shift;
+
+  /// is _u currently in its storage representation
+  bool _encoded;
+
+  /// storage representations set aside while an operator reads decoded temporaries
+  torch::Tensor _u_stored;
+  std::vector<torch::Tensor> _u_old_stored;
+
+  /// does _u hold dense file data read before the sparse storage layout was set up
+  bool _dense_file_data;
 };
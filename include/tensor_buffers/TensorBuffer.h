@@ -10,6 +10,8 @@
 
 #include "TensorBufferBase.h"
 
+#include <type_traits>
+
 /**
  * Tensor wrapper arbitrary tensor value dimensions
  */
@@ -30,6 +32,9 @@ public:
   virtual const torch::Tensor & getRawTensor() const override;
   virtual const torch::Tensor & getRawCPUTensor() override;
 
+  virtual void storeState(std::ostream & stream) override;
+  virtual void loadState(std::istream & stream) override;
+
 protected:
   /// current state of the tensor
   T _u;
@@ -100,6 +105,51 @@ TensorBuffer<T>::getRawCPUTensor()
   return _u_cpu;
 }
 
+template <typename T>
+void
+TensorBuffer<T>::storeState(std::ostream & stream)
+{
+  // batch dimension of NEML2 tensor types
+  int64_t batch_dim = 0;
+  if constexpr (!std::is_same_v<T, torch::Tensor>)
+    if (_u.defined())
+      batch_dim = _u.batch_dim();
+  stream.write(reinterpret_cast<const char *>(&batch_dim), sizeof(batch_dim));
+
+  const auto n_old = static_cast<int64_t>(_u_old.size());
+  stream.write(reinterpret_cast<const char *>(&n_old), sizeof(n_old));
+
+  MooseTensor::storeTensor(stream, _u);
+  for (const auto & u : _u_old)
+    MooseTensor::storeTensor(stream, u);
+}
+
+template <typename T>
+void
+TensorBuffer<T>::loadState(std::istream & stream)
+{
+  int64_t batch_dim, n_old;
+  stream.read(reinterpret_cast<char *>(&batch_dim), sizeof(batch_dim));
+  stream.read(reinterpret_cast<char *>(&n_old), sizeof(n_old));
+
+  const auto restore = [&stream, batch_dim]() -> T
+  {
+    const auto u = MooseTensor::loadTensor(stream);
+    if constexpr (std::is_same_v<T, torch::Tensor>)
+    {
+      libmesh_ignore(batch_dim);
+      return u;
+    }
+    else
+      return u.defined() ? T(u, batch_dim) : T();
+  };
+
+  _u = restore();
+  _u_old.resize(n_old);
+  for (auto & u : _u_old)
+    u = restore();
+}
+
 template <typename T>
 T &
 TensorBuffer<T>::getTensor()
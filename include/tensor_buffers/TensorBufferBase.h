@@ -35,6 +35,11 @@ public:
   /// create a contiguous CPU copy of the current tensor
   virtual void makeCPUCopy() = 0;
 
+  ///@{ write and read the current and old tensors for checkpoint/restart
+  virtual void storeState(std::ostream & stream) = 0;
+  virtual void loadState(std::istream & stream) = 0;
+  ///@}
+
   /// initialize the tensor
   virtual void init() {}
 
@@ -44,12 +49,28 @@ public:
   /// get a raw torch tensor representation
   virtual const torch::Tensor & getRawCPUTensor() = 0;
 
+  /// get the tensor in the form written by outputs (on the compute device)
+  virtual torch::Tensor getOutputTensor() const { return getRawTensor(); }
+
   /// expand the tensor to full dimensions
   void expand();
 
+  /// copy a tensor into a host staging buffer (pinned for device tensors) without waiting for the
+  /// copy to finish
+  torch::Tensor stageCPUCopy(const torch::Tensor & u);
+
   const bool _reciprocal;
 
   const torch::IntArrayRef _domain_shape;
 
   const torch::TensorOptions _options;
+
+protected:
+  /// host staging buffers, a buffer is reused once no queued output frame references it anymore
+  std::vector<torch::Tensor> _cpu_staging;
 };
+
+///@{ restartable data hooks for the buffers registered by TensorProblem
+void dataStore(std::ostream & stream, TensorBufferBase *& buffer, void * context);
+void dataLoad(std::istream & stream, TensorBufferBase *& buffer, void * context);
+///@}
@@ -28,7 +28,7 @@ protected:
   const torch::Tensor & _density;
   const torch::Tensor & _forces;
 
-  torch::Tensor _source_term = torch::zeros(_shape_q, MooseTensor::floatTensorOptions());
+  torch::Tensor _source_term;
 
   const Real _tau;
 };
@@ -11,7 +11,9 @@
 #include "LBMBoundaryCondition.h"
 
 /**
- * LBMBounceBack object
+ * LBMBounceBack object. The boundary methods collect the bounce-back links of the selected
+ * boundary as flat (cell, direction) indices once, computeBuffer applies them as a single
+ * gather/scatter.
  */
 class LBMBounceBack : public LBMBoundaryCondition
 {
@@ -27,12 +29,15 @@ public:
   void frontBoundary() override;
   void backBoundary() override;
   void wallBoundary() override;
-  void wallBoundary3D();
   void computeBuffer() override;
 
 protected:
   const std::vector<torch::Tensor> & _f_old;
 
+  /// both distributions are handled in their storage representation
+  const LBMTensorBuffer * const _f_old_buffer;
+  const LBMTensorBuffer * const _u_buffer;
+
   // whether or not apply bounce back in the corners
   const bool _exclude_corners_x;
   const bool _exclude_corners_y;
@@ -42,6 +47,13 @@ protected:
   torch::Tensor _y_indices;
   torch::Tensor _z_indices;
 
-  torch::Tensor _binary_mesh;
-  torch::Tensor _boundary_mask;
+  /// flat cell indices of a domain face at the given index along dim
+  torch::Tensor faceCells(unsigned int dim, int64_t index) const;
+  /// set the links replacing the incoming directions at the given cells
+  void setLinks(const torch::Tensor & cells, const torch::Tensor & directions);
+
+  /// flat indices of the bounced back entries in the output buffer
+  torch::Tensor _link_destination;
+  /// flat indices of the opposite direction entries in the old distribution
+  torch::Tensor _link_source;
 };
@@ -51,6 +51,9 @@ public:
 
   virtual void computeBuffer() override;
 
+  /// does the boundary touch the local block of a block decomposed domain
+  bool isOnLocalBlock() const;
+
 protected:
   const std::array<int64_t, 3> _grid_size;
 
@@ -23,8 +23,8 @@ public:
 
   void HermiteRegularization();
   void computeRelaxationParameter();
-  void computeLocalRelaxationMatrix();
-  void computeGlobalRelaxationMatrix();
+  void computeLocalRelaxationRates();
+  void computeGlobalRelaxationOperator();
 
   void BGKDynamics();
   void MRTDynamics();
@@ -36,18 +36,35 @@ public:
 protected:
   const torch::Tensor & _f;
   const torch::Tensor & _feq;
+
+  /// f, feq and the output are read and supplied in their storage representation
+  const LBMTensorBuffer * const _f_buffer;
+  const LBMTensorBuffer * const _feq_buffer;
+  const LBMTensorBuffer * const _u_buffer;
+
   torch::Tensor _fneq;
   torch::Tensor _relaxation_parameter;
-  torch::Tensor _local_relaxation_matrix;
-  torch::Tensor _global_relaxation_matrix;
 
-  const std::array<int64_t, 3> _shape;
+  /// transposed moment transforms for batched right multiplication
+  torch::Tensor _M_t;
+  torch::Tensor _M_inv_t;
+
+  /// constant moment space relaxation rates with the viscous moments zeroed out
+  torch::Tensor _relaxation_diagonal;
+  /// mask selecting the moments relaxed with the (local) viscous rate
+  torch::Tensor _viscous_moments;
+  /// per cell moment space relaxation rates (Smagorinsky MRT)
+  torch::Tensor _local_relaxation_rates;
+  /// (M^-1 S M)^T for constant relaxation times (MRT)
+  torch::Tensor _global_relaxation_operator;
+  /// q x 6 projection of fneq onto the symmetric non-equilibrium momentum flux (Smagorinsky)
+  torch::Tensor _momentum_flux_projection;
 
   const Real _tau_0;
   const Real _C_s;     // Smagorinsky constant
   const Real _delta_x; // grid resolution
   const bool _projection;
-  Real _mean_density;
+  torch::Tensor _mean_density;
 };
 
 typedef LBMCollisionDynamicsTempl<0> LBMBGKCollision;
@@ -24,4 +24,8 @@ public:
 
 protected:
   const torch::Tensor & _f;
+
+  /// f and the density are read and supplied in their storage representation
+  const LBMTensorBuffer * const _f_buffer;
+  const LBMTensorBuffer * const _u_buffer;
 };
@@ -26,6 +26,10 @@ protected:
   const torch::Tensor & _f;
   const torch::Tensor & _rho;
   const torch::Tensor & _force_tensor;
+
+  /// f is read in its storage representation
+  const LBMTensorBuffer * const _f_buffer;
+
   const Real & _body_force_constant_x;
   const Real & _body_force_constant_y;
   const Real & _body_force_constant_z;
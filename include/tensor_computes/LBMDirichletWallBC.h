@@ -34,7 +34,10 @@ protected:
   const std::vector<torch::Tensor> & _f_old;
 
   torch::Tensor _binary_mesh;
-  torch::Tensor _boundary_mask;
+  /// flat indices of the boundary entries in the distribution buffer
+  torch::Tensor _boundary_links;
+  /// equilibrium values at the boundary links
+  torch::Tensor _boundary_values;
   torch::Tensor _boundary_normals;
   torch::Tensor _boundary_tangent_vectors;
   torch::Tensor _e_xyz;
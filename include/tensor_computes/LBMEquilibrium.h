@@ -25,4 +25,7 @@ public:
 protected:
   const torch::Tensor & _rho;
   const torch::Tensor & _velocity;
+
+  /// the equilibrium is supplied in its storage representation
+  const LBMTensorBuffer * const _u_buffer;
 };
@@ -0,0 +1,57 @@
+/**********************************************************************/
+/*                    DO NOT MODIFY THIS HEADER                       */
+/*             Swift, a Fourier spectral solver for MOOSE             */
+/*                                                                    */
+/*            Copyright 2024 Battelle Energy Alliance, LLC            */
+/*                        ALL RIGHTS RESERVED                         */
+/**********************************************************************/
+
+#pragma once
+
+#include "LatticeBoltzmannOperator.h"
+
+/**
+ * Experimental CPU-only LBM update computing moments, equilibrium, BGK/MRT collision and streaming
+ * of the distribution function in a single pass over the grid
+ */
+class LBMFusedCollideStream : public LatticeBoltzmannOperator
+{
+public:
+  static InputParameters validParams();
+
+  LBMFusedCollideStream(const InputParameters & parameters);
+
+  void computeBuffer() override;
+
+protected:
+  /// plain scalar loop over the cells on the CPU, every cell is pushed to its neighbors
+  template <typename T>
+  void computeCPU();
+
+  /// optional outputs
+  torch::Tensor * const _f_post_collision;
+  torch::Tensor * const _density;
+  torch::Tensor * const _velocity;
+
+  enum class Collision
+  {
+    BGK,
+    MRT
+  } _collision;
+
+  const Real _tau_0;
+
+  /// constant body force added as a velocity shift
+  std::array<Real, 3> _body_force;
+
+  /// host copies of the stencil and of (M^-1 S M)^T for MRT collision
+  std::vector<std::array<int64_t, 3>> _e_host;
+  std::vector<Real> _w_host;
+  std::vector<Real> _relaxation_operator_host;
+
+  /// periodic neighbor coordinates at offsets -1, 0, +1 for each cell coordinate along x, y, z
+  std::array<std::vector<std::array<int64_t, 3>>, 3> _neighbor_host;
+
+  /// fluid node mask for binary media
+  torch::Tensor _fluid;
+};
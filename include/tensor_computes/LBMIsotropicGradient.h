@@ -20,14 +20,19 @@ public:
 
   LBMIsotropicGradient(const InputParameters & parameters);
 
-  torch::Tensor padScalarField();
   virtual void computeBuffer() override;
 
 protected:
+  /// convolve a field with the 3^dim kernels {n, 1, 3, 3[, 3]} after padding it by one layer
+  torch::Tensor convolve(const torch::Tensor & field, const torch::Tensor & kernel) const;
+
+  /// flat index of every lattice velocity in a 3x3x3 kernel
+  torch::Tensor stencilKernelIndices() const;
+
   const torch::Tensor & _scalar_field;
-  const int64_t _padding = (3 - 1) / 2;
-  torch::IntArrayRef _pad_dims = {_padding, _padding, _padding, _padding};
+
+  /// continuation of the field across the domain faces
+  const enum class Padding { replicate, circular } _padding;
 
   torch::Tensor _kernel;
-  torch::nn::functional::Conv2dFuncOptions _conv_options;
 };
@@ -12,6 +12,7 @@
 
 class LatticeBoltzmannProblem;
 class LatticeBoltzmannStencilBase;
+class LBMTensorBuffer;
 
 /**
  * LatticeBoltzmannOperator object
@@ -24,6 +25,22 @@ public:
   LatticeBoltzmannOperator(const InputParameters & parameters);
 
 protected:
+  /**
+   * Read (or supply) a buffer in its storage representation rather than having the problem convert
+   * it to the compute precision around this operator. Returns nullptr for buffers that are not
+   * LBMTensorBuffers (those are always in compute precision).
+   */
+  const LBMTensorBuffer * useStorageRepresentation(const std::string & buffer_name);
+
+  /// is a buffer obtained from useStorageRepresentation currently in its storage representation
+  static bool isEncoded(const LBMTensorBuffer * buffer);
+
+  /// compute precision values minus the current representation of a buffer
+  const torch::Tensor & storageOffset(const LBMTensorBuffer * buffer) const;
+
+  /// convert a compute precision result to the current representation of a buffer
+  static torch::Tensor toStorage(const LBMTensorBuffer * buffer, const torch::Tensor & t);
+
   LatticeBoltzmannProblem & _lb_problem;
   const LatticeBoltzmannStencilBase & _stencil;
 
@@ -34,4 +51,10 @@ protected:
 
   const std::vector<int64_t> & _shape;
   const std::vector<int64_t> & _shape_q;
+
+  /// compute precision floating point type
+  const torch::ScalarType _compute_dtype;
+
+  /// offset of buffers held in compute precision
+  const torch::Tensor _no_offset;
 };
@@ -9,8 +9,12 @@
 #pragma once
 
 #include "MooseObject.h"
+#include <condition_variable>
+#include <deque>
+#include <mutex>
 #include <thread>
 #include <torch/torch.h>
+#include <c10/core/Event.h>
 
 class TensorBufferBase;
 class TensorProblem;
@@ -25,30 +29,106 @@ public:
   static InputParameters validParams();
 
   TensorOutput(const InputParameters & parameters);
+  virtual ~TensorOutput();
 
   virtual void init() {}
 
   virtual bool shouldRun(const ExecFlagType & execute_flag) const;
 
-  void startOutput();
+  /**
+   * Queue a snapshot of the CPU buffers for output. This only blocks if the queue is full. The
+   * optional event marks the completion of asynchronous device to host copies.
+   */
+  void startOutput(std::shared_ptr<c10::Event> ready = nullptr);
+
+  /// extract the selected output grid on the device and start copying it to the host
+  void stageSelection();
+
+  /// wait until all queued frames are written
   void waitForCompletion();
 
+  ///@{ write and read the output progress for checkpoint/recover (called with an empty queue)
+  virtual void storeState(std::ostream & /*stream*/) {}
+  virtual void loadState(std::istream & /*stream*/) {}
+  ///@}
+
 protected:
   virtual void output() = 0;
 
+  /// output thread main loop, writes queued frames in order
+  void processQueue();
+
+  /// set up the (subvolume, slab, and subsampling) selection of the output grid
+  void setupOutputGrid();
+
+  /// extract the selected part of a tensor on its device
+  torch::Tensor extractOutput(const torch::Tensor & tensor) const;
+
   TensorProblem & _tensor_problem;
   const DomainAction & _domain;
 
   /// simulation time of the step that is being output
-  const Real & _time;
+  Real _time;
 
   /// output file name prefix
   const std::string _file_base;
 
   std::thread _output_thread;
 
-  /// The buffer this output object is outputting
+  /// run output() in the dedicated thread (outputs that need MPI may have to run synchronously)
+  bool _asynchronous;
+
+  /// The buffer this output object is outputting (points into the frame that is being written)
   std::map<std::string, const torch::Tensor *> _out_buffers;
 
+  /// CPU copies of the output buffers maintained by the problem
+  std::map<std::string, const torch::Tensor *> _cpu_buffers;
+
+  /// output buffers that are subsampled on the device
+  std::map<std::string, TensorBufferBase *> _selected_buffers;
+
+  /// host copies of the selected output grids for the next frame
+  std::map<std::string, torch::Tensor> _staged_selection;
+
+  /// is only a part of the grid (or a subsampled grid) written
+  bool _has_selection;
+
+  /// selected grid index range and subsampling stride along each direction
+  std::array<int64_t, 3> _output_begin;
+  std::array<int64_t, 3> _output_end;
+  std::array<int64_t, 3> _stride;
+
+  /// subsample by Fourier truncation rather than by picking every n-th cell
+  bool _spectral;
+
+  /// size, spacing, and origin of the output grid
+  std::array<int64_t, 3> _output_grid_size;
+  RealVectorValue _output_grid_spacing;
+  RealVectorValue _output_origin;
+
+  /// buffer snapshots and time of one output step
+  struct Frame
+  {
+    Real time;
+    std::map<std::string, torch::Tensor> buffers;
+    std::shared_ptr<c10::Event> ready;
+  };
+
+  /// maximum number of frames that are queued or being written
+  const unsigned int _queue_size;
+
+  /// frames waiting for output, the front frame is the one being written
+  std::deque<Frame> _queue;
+  std::mutex _queue_mutex;
+  std::condition_variable _queue_condition;
+
+  /// signals the output thread to exit
+  bool _shutdown;
+
   const ExecFlagEnum _execute_on;
 };
+
+///@{ restartable data hooks for the outputs registered by TensorProblem
+void dataStore(std::ostream & stream, TensorOutput *& output, void * context);
+void dataLoad(std::istream & stream, TensorOutput *& output, void * context);
+///@}
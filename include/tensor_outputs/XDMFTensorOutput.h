@@ -29,12 +29,18 @@ public:
 
   virtual void init() override;
 
+  virtual void storeState(std::ostream & stream) override;
+  virtual void loadState(std::istream & stream) override;
+
 protected:
   virtual void output() override;
 
   torch::Tensor extendTensor(torch::Tensor tensor);
   torch::Tensor upsampleTensor(torch::Tensor tensor);
 
+  /// append a timestep grid to the XDMF file, overwriting and then restoring the closing tags
+  void appendXDMFGrid(const pugi::xml_node & grid);
+
   /// mesh dimension
   const unsigned int _dim;
 
@@ -42,6 +48,12 @@ protected:
   pugi::xml_document _doc;
   pugi::xml_node _tgrid;
 
+  /// closing tags following the last timestep grid in the XDMF file
+  std::string _xdmf_tail;
+
+  /// size of the XDMF file after the last appended timestep grid
+  std::size_t _xdmf_size;
+
   /// node grid is original buffer dimensions plus one
   std::vector<std::size_t> _nnode;
   std::string _node_grid;
@@ -66,6 +78,13 @@ protected:
   /// whether the tensor uses Cell or Node output
   std::map<std::string, OutputMode> _output_mode;
 
+  /// is the domain decomposed, with each rank holding only a part of the grid
+  bool _distributed;
+
+  /// global offset and size of the local part of the cell and node data
+  std::array<std::vector<std::size_t>, 2> _local_offset;
+  std::array<std::vector<std::size_t>, 2> _local_count;
+
 #ifdef LIBMESH_HAVE_HDF5
   const bool _enable_hdf5;
 
@@ -74,6 +93,47 @@ protected:
 
   /// HDF5 file handle
   hid_t _hdf5_file_id;
+
+  /// build the dataset creation property list (chunking and filters) for the given data shape
+  hid_t datasetCreationPropertyList(const std::vector<std::size_t> & ndata,
+                                    bool time_series) const;
+
+  /// write the local part of the current frame into the extendible time series dataset of a field
+  void writeTimeSeriesFrame(const std::string & name,
+                            const void * data,
+                            const std::vector<std::size_t> & ndata,
+                            const std::vector<std::size_t> & offset,
+                            const std::vector<std::size_t> & count,
+                            hid_t type,
+                            hid_t plist_id,
+                            bool write = true);
+
+  /// HDF5 chunk size along each spatial direction (empty for a single chunk)
+  const std::vector<unsigned int> _chunk_size;
+
+  /// HDF5 compression filter
+  const enum class Compression { NONE, DEFLATE, SHUFFLE_DEFLATE, LZ4, ZSTD } _compression;
+
+  /// compression level for DEFLATE and ZSTD
+  const unsigned int _compression_level;
+
+  /// dataset creation property lists for cell and node data
+  std::array<hid_t, 2> _dataset_plist;
+
+  /// one dataset per field and frame or one extendible dataset per field
+  const enum class HDF5Layout { PER_FRAME, TIME_SERIES } _hdf5_layout;
+
+  /// open time series datasets (including the output times) and their property list
+  std::map<std::string, hid_t> _time_series_dataset;
+  hid_t _times_plist;
+
+  /// dataset transfer property list (collective MPI-IO for decomposed domains)
+  hid_t _xfer_plist;
+
+#ifdef H5_HAVE_PARALLEL
+  /// communicator for the collective HDF5 calls issued from the output thread
+  MPI_Comm _hdf5_comm;
+#endif
 #endif
 };
 
@@ -12,6 +12,7 @@
 
 class LatticeBoltzmannProblem;
 class LatticeBoltzmannStencilBase;
+class LBMTensorBuffer;
 
 /**
  * LBM Stream object
@@ -33,6 +34,10 @@ protected:
   {
     torch::Tensor & _u;
     const std::vector<torch::Tensor> & _f_old;
+
+    /// streaming works on the storage representation of the distributions
+    const LBMTensorBuffer * _u_buffer;
+    const LBMTensorBuffer * _f_old_buffer;
   };
 
   std::vector<Variable> _variables;
@@ -44,6 +44,12 @@ const torch::TensorOptions intTensorOptions();
 /// unsqueeze(0) ndim times
 torch::Tensor unsqueeze0(const torch::Tensor & t, unsigned int ndim);
 
+/// write a tensor as a small header (dtype and shape) followed by its raw contiguous data
+void storeTensor(std::ostream & stream, const torch::Tensor & t);
+
+/// read a tensor written by storeTensor and move it to the compute device
+torch::Tensor loadTensor(std::istream & stream);
+
 torch::Tensor trans2(const torch::Tensor & A2);
 torch::Tensor ddot42(const torch::Tensor & A4, const torch::Tensor & B2);
 torch::Tensor ddot44(const torch::Tensor & A4, const torch::Tensor & B4);
@@ -0,0 +1,43 @@
+/**********************************************************************/
+/*                    DO NOT MODIFY THIS HEADER                       */
+/*             Swift, a Fourier spectral solver for MOOSE             */
+/*                                                                    */
+/*            Copyright 2024 Battelle Energy Alliance, LLC            */
+/*                        ALL RIGHTS RESERVED                         */
+/**********************************************************************/
+
+#pragma once
+
+#include "TensorPostprocessor.h"
+
+/**
+ * Compute the radially averaged structure factor of a Tensor buffer
+ */
+class TensorStructureFactor : public TensorVectorPostprocessor
+{
+public:
+  static InputParameters validParams();
+
+  TensorStructureFactor(const InputParameters & parameters);
+
+  virtual void initialize() override {}
+  virtual void execute() override;
+  virtual void finalize() override {}
+
+protected:
+  /// width of the k-shells
+  Real _dk;
+
+  /// number of k-shells
+  int64_t _bins;
+
+  /// k-shell index of every reciprocal space entry (entries beyond the last shell map to _bins)
+  torch::Tensor _shell;
+
+  /// number of modes represented by each entry of the half-space (real to complex) transform
+  torch::Tensor _weights;
+
+  VectorPostprocessorValue & _k_vec;
+  VectorPostprocessorValue & _s_vec;
+  VectorPostprocessorValue & _modes_vec;
+};
@@ -18,6 +18,7 @@ class HDF5Diff(FileTester):
         params = FileTester.validParams()
         params.addRequiredParam('hdf5diff', [], 'A list of files to compare against the gold.')
         params.addParam('abs_tol', 1e-15, 'Absolute tolerance.')
+        params.addParam('rel_tol', 0.0, 'Relative tolerance. Values within rel_tol times the gold value pass even if they exceed abs_tol.')
         return params
 
     def __init__(self, name, params):
@@ -43,6 +44,7 @@ class HDF5Diff(FileTester):
             return output
 
         abs_tol = self.specs['abs_tol']
+        rel_tol = self.specs['rel_tol']
 
         # Loop through files
         specs = self.specs
@@ -79,9 +81,13 @@ class HDF5Diff(FileTester):
                         self.setStatus(self.fail, 'HDF5 DIFF')
 
                     else:
-                        diff = np.max(np.abs(gold_set - test_set))
-                        if diff > abs_tol:
-                            output += f"Absolute tolerance exceeded in '{dataset}' (diff:{diff}, abs_tol:{abs_tol})\n"
+                        diff = np.abs(gold_set - test_set)
+                        if rel_tol == 0.0:
+                            if np.max(diff) > abs_tol:
+                                output += f"Absolute tolerance exceeded in '{dataset}' (diff:{np.max(diff)}, abs_tol:{abs_tol})\n"
+                                self.setStatus(self.fail, 'HDF5 DIFF')
+                        elif np.any(diff > np.maximum(abs_tol, rel_tol * np.abs(gold_set))):
+                            output += f"Tolerance exceeded in '{dataset}' (diff:{np.max(diff)}, abs_tol:{abs_tol}, rel_tol:{rel_tol})\n"
                             self.setStatus(self.fail, 'HDF5 DIFF')
 
         return output
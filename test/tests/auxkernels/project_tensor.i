@@ -0,0 +1,87 @@
+#
+# Project a buffer holding a linear function of the cell centre coordinates onto an elemental
+# variable on a domain with negative lower bounds, and compare it to the same function evaluated
+# by MOOSE.
+#
+
+[Domain]
+  dim = 2
+  nx = 10
+  ny = 8
+  xmin = -3
+  xmax = 2
+  ymin = -2
+  ymax = 2
+  mesh_mode = DOMAIN
+[]
+
+[TensorComputes]
+  [Initialize]
+    [u]
+      type = ParsedCompute
+      buffer = u
+      expression = 'x + 10*y'
+      extra_symbols = true
+      expand = REAL
+    []
+  []
+[]
+
+[Functions]
+  [u]
+    type = ParsedFunction
+    expression = 'x + 10*y'
+  []
+[]
+
+[AuxVariables]
+  [u_projected]
+    family = MONOMIAL
+    order = CONSTANT
+  []
+  [u_exact]
+    family = MONOMIAL
+    order = CONSTANT
+  []
+[]
+
+[AuxKernels]
+  [u_projected]
+    type = ProjectTensorAux
+    buffer = u
+    variable = u_projected
+    execute_on = TIMESTEP_END
+  []
+  [u_exact]
+    type = FunctionAux
+    function = u
+    variable = u_exact
+    execute_on = TIMESTEP_END
+  []
+[]
+
+[Postprocessors]
+  [difference]
+    type = ElementL2Difference
+    variable = u_projected
+    other_variable = u_exact
+  []
+  [max]
+    type = ElementExtremeValue
+    variable = u_projected
+  []
+[]
+
+[Problem]
+  type = TensorProblem
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 1
+[]
+
+[Outputs]
+  csv = true
+  execute_on = TIMESTEP_END
+[]
@@ -0,0 +1,83 @@
+#
+# Fill a buffer from an elemental AuxVariable holding a linear function of the coordinates and
+# compare it to the same function evaluated at the cell centres of the tensor grid.
+#
+
+[Domain]
+  dim = 2
+  nx = 10
+  ny = 8
+  xmin = -3
+  xmax = 2
+  ymin = -2
+  ymax = 2
+  mesh_mode = DOMAIN
+[]
+
+[TensorBuffers]
+  [u_fe]
+    map_from_aux_variable = u
+  []
+[]
+
+[TensorComputes]
+  [Solve]
+    [error]
+      type = ParsedCompute
+      buffer = error
+      inputs = u_fe
+      expression = 'abs(u_fe - (x + 10*y))'
+      extra_symbols = true
+    []
+  []
+[]
+
+[Functions]
+  [u]
+    type = ParsedFunction
+    expression = 'x + 10*y'
+  []
+[]
+
+[AuxVariables]
+  [u]
+    family = MONOMIAL
+    order = CONSTANT
+  []
+[]
+
+[AuxKernels]
+  [u]
+    type = FunctionAux
+    function = u
+    variable = u
+    execute_on = INITIAL
+  []
+[]
+
+[Postprocessors]
+  [error]
+    type = TensorExtremeValuePostprocessor
+    buffer = error
+    value_type = MAX
+  []
+  [max]
+    type = TensorExtremeValuePostprocessor
+    buffer = u_fe
+    value_type = MAX
+  []
+[]
+
+[Problem]
+  type = TensorProblem
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 1
+[]
+
+[Outputs]
+  csv = true
+  execute_on = TIMESTEP_END
+[]
@@ -0,0 +1,118 @@
+[Domain]
+  dim = 2
+  nx = 10
+  ny = 10
+  mesh_mode = DUMMY
+[]
+
+[Stencil]
+  [d2q9]
+    type = LBMD2Q9
+  []
+[]
+
+[TensorBuffers]
+  [f]
+    type = LBMTensorBuffer
+    buffer_type = df
+  []
+  [fpc]
+    type = LBMTensorBuffer
+    buffer_type = df
+  []
+  [velocity]
+    type=LBMTensorBuffer
+    buffer_type = mv
+  []
+  [density]
+    type=LBMTensorBuffer
+    buffer_type = ms
+  []
+  [speed]
+    type=LBMTensorBuffer
+    buffer_type = ms
+  []
+[]
+
+[TensorComputes]
+  [Initialize]
+    [initial_density]
+      type = LBMConstantTensor
+      buffer = density
+      constants = 1.0
+    []
+    [initial_velocity]
+      type = LBMConstantTensor
+      buffer = velocity
+      constants = '0.0 0.0'
+    []
+    [initial_distribution]
+      type = LBMEquilibrium
+      buffer = f
+      bulk = density
+      velocity = velocity
+    []
+    [initial_distribution_pc]
+      type = LBMEquilibrium
+      buffer = fpc
+      bulk = density
+      velocity = velocity
+    []
+  []
+  [Solve]
+    [collide_stream]
+      type = LBMFusedCollideStream
+      buffer = f
+      f_post_collision = fpc
+      density = density
+      velocity = velocity
+      tau0 = 1.0
+      add_body_force = true
+      body_force_x = 0.0001
+    []
+    [speed]
+      type = LBMComputeVelocityMagnitude
+      buffer = speed
+      velocity = velocity
+    []
+    [residual]
+      type = LBMComputeResidual
+      buffer = speed
+      speed = speed
+    []
+  []
+  [Boundary]
+    [top]
+      type = LBMBounceBack
+      buffer = f
+      f_old = fpc
+      boundary = top
+    []
+    [bottom]
+      type = LBMBounceBack
+      buffer = f
+      f_old = fpc
+      boundary = bottom
+    []
+  []
+[]
+
+[Problem]
+  type = LatticeBoltzmannProblem
+  substeps = 100
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 2
+[]
+
+[TensorOutputs]
+  [xdmf2]
+    type = XDMFTensorOutput
+    buffer = 'velocity'
+    output_mode = 'Cell'
+    enable_hdf5 = true
+    file_base = channel2D
+  []
+[]
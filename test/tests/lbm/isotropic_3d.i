@@ -0,0 +1,166 @@
+# cos(2 pi x / 8) sampled at the cell centres is even about both domain faces, so replicate and
+# circular padding continue it identically and both must reproduce the discrete analytic result
+padding = circular
+
+[Domain]
+  dim = 3
+  nx = 8
+  ny = 8
+  nz = 8
+  xmax = 8
+  ymax = 8
+  zmax = 8
+  mesh_mode = DUMMY
+[]
+
+[Stencil]
+  [d3q27]
+    type = LBMD3Q27
+  []
+[]
+
+[TensorBuffers]
+  [phi]
+    type = LBMTensorBuffer
+    buffer_type = ms
+  []
+  [grad_phi]
+    type = LBMTensorBuffer
+    buffer_type = mv
+  []
+  [laplacian_phi]
+    type = LBMTensorBuffer
+    buffer_type = ms
+  []
+  [dphi_dx]
+    type = LBMTensorBuffer
+    buffer_type = ms
+  []
+  [dphi_dy]
+    type = LBMTensorBuffer
+    buffer_type = ms
+  []
+  [dphi_dz]
+    type = LBMTensorBuffer
+    buffer_type = ms
+  []
+  [grad_exact]
+    type = LBMTensorBuffer
+    buffer_type = mv
+  []
+  [grad_error]
+    type = LBMTensorBuffer
+    buffer_type = mv
+  []
+  [laplacian_error]
+    type = LBMTensorBuffer
+    buffer_type = ms
+  []
+[]
+
+[TensorComputes]
+  [Initialize]
+    [phi]
+      type = ParsedCompute
+      buffer = phi
+      enable_jit = true
+      expression = 'cos(2*pi*x/8)'
+      extra_symbols = true
+      expand = REAL
+    []
+    # central differences of cos(k x) over one lattice spacing
+    [dphi_dx]
+      type = ParsedCompute
+      buffer = dphi_dx
+      enable_jit = true
+      expression = '-sin(2*pi*x/8)*sin(2*pi/8)'
+      extra_symbols = true
+      expand = REAL
+    []
+    [dphi_dy]
+      type = ParsedCompute
+      buffer = dphi_dy
+      expression = '0'
+      expand = REAL
+    []
+    [dphi_dz]
+      type = ParsedCompute
+      buffer = dphi_dz
+      expression = '0'
+      expand = REAL
+    []
+    [grad_exact]
+      type = LBMStackTensors
+      buffer = grad_exact
+      inputs = 'dphi_dx dphi_dy dphi_dz'
+    []
+  []
+  [Solve]
+    [grad_phi]
+      type = LBMIsotropicGradient
+      buffer = grad_phi
+      scalar_field = phi
+      padding = ${padding}
+    []
+    [laplacian_phi]
+      type = LBMIsotropicLaplacian
+      buffer = laplacian_phi
+      scalar_field = phi
+      padding = ${padding}
+    []
+    [grad_error]
+      type = ParsedCompute
+      buffer = grad_error
+      inputs = 'grad_phi grad_exact'
+      expression = 'abs(grad_phi - grad_exact)'
+    []
+    # the discrete Laplacian of cos(k x) is -2 (1 - cos(k)) cos(k x)
+    [laplacian_error]
+      type = ParsedCompute
+      buffer = laplacian_error
+      inputs = 'laplacian_phi phi'
+      expression = 'abs(laplacian_phi + 2*(1-cos(2*pi/8))*phi)'
+      extra_symbols = true
+    []
+  []
+[]
+
+[Problem]
+  type = LatticeBoltzmannProblem
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 2
+[]
+
+[Postprocessors]
+  [grad_error]
+    type = TensorExtremeValuePostprocessor
+    buffer = grad_error
+    value_type = MAX
+  []
+  [grad_max]
+    type = TensorExtremeValuePostprocessor
+    buffer = grad_phi
+    value_type = MAX
+  []
+  [laplacian_error]
+    type = TensorExtremeValuePostprocessor
+    buffer = laplacian_error
+    value_type = MAX
+  []
+  [laplacian_max]
+    type = TensorExtremeValuePostprocessor
+    buffer = laplacian_phi
+    value_type = MAX
+  []
+[]
+
+[Outputs]
+  [csv]
+    type = CSV
+    file_base = isotropic_3d_${padding}
+    execute_on = FINAL
+  []
+[]
@@ -0,0 +1,161 @@
+[Domain]
+  dim = 2
+  nx = 11
+  ny = 11
+  mesh_mode = DUMMY
+[]
+
+[Stencil]
+  [d2q9]
+    type = LBMD2Q9
+  []
+[]
+
+[TensorBuffers]
+  [rho]
+    type = LBMTensorBuffer
+    buffer_type = ms
+  []
+  [u]
+    type = LBMTensorBuffer
+    buffer_type = mv
+  []
+  [speed]
+    type = LBMTensorBuffer
+    buffer_type = ms
+  []
+  [f]
+    type = LBMTensorBuffer
+    buffer_type = df
+  []
+  [feq]
+    type = LBMTensorBuffer
+    buffer_type = df
+  []
+  [f_post_collision]
+    type = LBMTensorBuffer
+    buffer_type = df
+  []
+  [binary_media]
+    type = LBMTensorBuffer
+    file = binary_media.h5
+    is_integer = true
+    buffer_type = ms
+  []
+[]
+
+[TensorComputes]
+  [Initialize]
+    [rho]
+      type = LBMConstantTensor
+      buffer = rho
+      constants = 1.0
+    []
+    [u]
+      type = LBMConstantTensor
+      buffer = u
+      constants = '0.0 0.0'
+    []
+    [feq]
+      type = LBMEquilibrium
+      buffer = feq
+      bulk = rho
+      velocity = u
+    []
+    [f]
+      type = LBMEquilibrium
+      buffer = f
+      bulk = rho
+      velocity = u
+    []
+    [f_post_coll]
+      type = LBMEquilibrium
+      buffer = f_post_collision
+      bulk = rho
+      velocity = u
+    []
+  []
+  [Solve]
+    [Density]
+      type = LBMComputeDensity
+      buffer = rho
+      f = f
+    []
+    [Velocity]
+      type = LBMComputeVelocity
+      buffer = u
+      f = f
+      rho = rho
+      add_body_force = true
+      body_force_x = 0.0001
+    []
+    [Equilibrium]
+      type = LBMEquilibrium
+      buffer = feq
+      bulk = rho
+      velocity = u
+    []
+    [Collision]
+      type = LBMBGKCollision
+      buffer = f_post_collision
+      f = f
+      feq = feq
+      tau0 = 0.8
+    []
+    [Speed]
+      type = LBMComputeVelocityMagnitude
+      buffer = speed
+      velocity = u
+    []
+    [Residual]
+      type = LBMComputeResidual
+      buffer = speed
+      speed = speed
+    []
+  []
+  [Boundary]
+    [wall]
+      type = LBMBounceBack
+      buffer = f
+      f_old = f_post_collision
+      boundary = wall
+    []
+  []
+[]
+
+[TensorSolver]
+  type = LBMStream
+  buffer = f
+  f_old = f_post_collision
+[]
+
+[Postprocessors]
+  [speed_max]
+    type = TensorExtremeValuePostprocessor
+    buffer = speed
+    value_type = MAX
+    execute_on = 'TIMESTEP_END'
+  []
+[]
+
+[Problem]
+  type = LatticeBoltzmannProblem
+  substeps = 10
+  binary_media = binary_media
+  sparse_storage = true
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 3
+[]
+
+[TensorOutputs]
+  [xdmf]
+    type = XDMFTensorOutput
+    # rho is not written, the dense run leaves the initial constant in the solid nodes
+    buffer = 'u speed binary_media'
+    output_mode = 'Cell Cell Cell'
+    enable_hdf5 = true
+  []
+[]
@@ -0,0 +1,54 @@
+# sin(x) on a 2 pi periodic box puts all power into the two modes k = (+-1, 0), i.e. the k = 1 shell
+
+[Domain]
+  dim = 2
+  nx = 16
+  ny = 16
+  xmax = '${fparse 2*pi}'
+  ymax = '${fparse 2*pi}'
+  mesh_mode = DUMMY
+[]
+
+[TensorBuffers]
+  [c]
+  []
+[]
+
+[TensorComputes]
+  [Initialize]
+    [c]
+      type = ParsedCompute
+      buffer = c
+      extra_symbols = true
+      expression = 'sin(x)'
+      expand = REAL
+    []
+    [c_bar]
+      type = ForwardFFT
+      buffer = c_bar
+      input = c
+    []
+  []
+[]
+
+[VectorPostprocessors]
+  [sk]
+    type = TensorStructureFactor
+    buffer = c_bar
+    execute_on = 'TIMESTEP_END'
+  []
+[]
+
+[Problem]
+  type = TensorProblem
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 1
+[]
+
+[Outputs]
+  csv = true
+  execute_on = 'TIMESTEP_END'
+[]